@@ -52,6 +52,9 @@ ln -s ../tools/seq/v6_ronnie_mod
 ln -s ../tools/seq/moovmaker
 ln -s ../tools/seq/grid_perturb_cmplx
 ln -s ../tools/seq/v6_restart_mod
+ln -s ../tools/seq/v6_restart_chunk
+ln -s ../tools/seq/flux_bench
+ln -s ../tools/seq/btri_bench
 ln -s ../tools/seq/gridswitchijk
 ln -s ../tools/seq/cfl3d_to_nmf
 ln -s ../tools/seq/cgns_readhist